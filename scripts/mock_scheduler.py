@@ -0,0 +1,502 @@
+#!/usr/bin/env python3
+#
+#  mock_scheduler.py
+#
+#  A fake PBS/SGE/SLURM batch scheduler for exercising the IQmol server
+#  code without access to a real cluster.
+#
+#  The script behaves as a scheduler command when invoked under one of the
+#  command names (qsub, qstat, qdel, sbatch, sacct, scancel, squeue, sinfo).
+#  Create the links with:
+#
+#     ./mock_scheduler.py --install ~/mock-bin
+#
+#  and put ~/mock-bin at the front of the PATH seen by the (local or ssh)
+#  shell that IQmol connects to.  The queue flavour used by qsub/qstat/qdel
+#  is taken from MOCK_SCHEDULER (pbs or sge, default pbs).  Jobs do not run;
+#  they sit in the queue for MOCK_QUEUE_TIME seconds, run for MOCK_RUN_TIME
+#  seconds and on completion leave MOCK_OUTPUT_KB of output in the job
+#  directory so the copy step has something to transfer.  Every command
+#  sleeps for MOCK_LATENCY seconds (+/- MOCK_JITTER) before answering and
+#  its output is throttled to MOCK_BANDWIDTH bytes/s, if set.  State and a
+#  log of every call are kept in MOCK_SPOOL (default ~/.mock_scheduler).
+#
+#  With IQmol pointed at the mock, summarize the scheduler traffic with:
+#
+#     ./mock_scheduler.py --report
+#
+#  The ServerScheduler tests (src/Process/test/ServerSchedulerTest.C, run by
+#  ctest) use the mock to drive Process::Server through a local connection
+#  with the default command templates from ServerConfiguration.
+#
+
+import argparse
+import fcntl
+import json
+import os
+import random
+import sys
+import time
+
+
+COMMANDS = ["qsub", "qstat", "qdel", "sbatch", "sacct", "scancel", "squeue", "sinfo"]
+
+
+def env_float(name, default):
+    try:
+        return float(os.environ.get(name, default))
+    except ValueError:
+        return float(default)
+
+
+def spool_dir():
+    path = os.environ.get("MOCK_SPOOL", os.path.expanduser("~/.mock_scheduler"))
+    os.makedirs(path, exist_ok=True)
+    return path
+
+
+def format_time(seconds):
+    seconds = int(max(0, seconds))
+    return "%02d:%02d:%02d" % (seconds // 3600, (seconds // 60) % 60, seconds % 60)
+
+
+#------------------------------------------------------------------------
+# Scheduler state
+#------------------------------------------------------------------------
+
+class Spool:
+    """Job table shared by all invocations, guarded by an exclusive lock."""
+
+    def __init__(self):
+        self.path = spool_dir()
+        self.lock = open(os.path.join(self.path, "lock"), "w")
+        fcntl.flock(self.lock, fcntl.LOCK_EX)
+        self.file = os.path.join(self.path, "jobs.json")
+        try:
+            with open(self.file) as f:
+                self.state = json.load(f)
+        except (IOError, ValueError):
+            self.state = {"next_id": 1000, "jobs": {}}
+
+    def save(self):
+        tmp = self.file + ".tmp"
+        with open(tmp, "w") as f:
+            json.dump(self.state, f)
+        os.replace(tmp, self.file)
+
+    def close(self):
+        fcntl.flock(self.lock, fcntl.LOCK_UN)
+        self.lock.close()
+
+    def submit(self, script):
+        job_id = str(self.state["next_id"])
+        self.state["next_id"] += 1
+        name = os.path.splitext(os.path.basename(script))[0]
+        now = time.time()
+        queue_time = env_float("MOCK_QUEUE_TIME", 5)
+        run_time = env_float("MOCK_RUN_TIME", 30)
+        self.state["jobs"][job_id] = {
+            "name": name,
+            "script": os.path.basename(script),
+            "dir": os.getcwd(),
+            "submitted": now,
+            "started": now + queue_time,
+            "finished": now + queue_time + run_time,
+            "killed": None,
+            "output_kb": env_float("MOCK_OUTPUT_KB", 64),
+            "output_written": False,
+        }
+        return job_id
+
+    def find(self, job_id):
+        return self.state["jobs"].get(job_id.split(".")[0].strip())
+
+    def status(self, job):
+        """Returns one of queued, running, finished or killed."""
+        now = time.time()
+        if job["killed"] is not None:
+            return "killed"
+        if now >= job["finished"]:
+            self.write_output(job)
+            return "finished"
+        if now >= job["started"]:
+            return "running"
+        return "queued"
+
+    def cpu_time(self, job):
+        end = job["killed"] or min(time.time(), job["finished"])
+        return max(0, end - job["started"])
+
+    def write_output(self, job):
+        if job["output_written"]:
+            return
+        job["output_written"] = True
+        path = os.path.join(job["dir"], job["name"] + ".out")
+        try:
+            with open(path, "w") as f:
+                line = "Mock output for %s\n" % job["name"]
+                remaining = int(job["output_kb"] * 1024)
+                while remaining > 0:
+                    chunk = line[:remaining]
+                    f.write(chunk)
+                    remaining -= len(chunk)
+        except IOError:
+            pass
+
+    def kill(self, job_id):
+        job = self.find(job_id)
+        if job is None:
+            return False
+        if self.status(job) in ("queued", "running"):
+            job["killed"] = time.time()
+        return True
+
+    def active(self):
+        return [(i, j) for i, j in sorted(self.state["jobs"].items(), key=lambda x: int(x[0]))
+                if self.status(j) in ("queued", "running")]
+
+
+#------------------------------------------------------------------------
+# Scheduler commands.  Each returns (stdout, stderr, exit code).
+#------------------------------------------------------------------------
+
+def split_ids(args):
+    ids = []
+    for arg in args:
+        ids.extend([i for i in arg.split(",") if i])
+    return ids
+
+
+def pbs_qsub(spool, args):
+    scripts = [a for a in args if not a.startswith("-")]
+    if not scripts or not os.path.isfile(scripts[-1]):
+        return "", "qsub: script file cannot be loaded\n", 1
+    return spool.submit(scripts[-1]) + ".mock\n", "", 0
+
+
+def pbs_qstat(spool, args):
+    if "-fQ" in args or "-Q" in args:
+        return ("Queue: batch\n    queue_type = Execution\n"
+                "    total_jobs = %d\n    enabled = True\n    started = True\n"
+                % len(spool.active())), "", 0
+
+    ids = split_ids([a for a in args if not a.startswith("-")])
+    full = any(a.startswith("-") and "f" in a for a in args)
+    history = any(a.startswith("-") and "x" in a for a in args)
+    codes = {"queued": "Q", "running": "R", "finished": "F", "killed": "F"}
+
+    if not ids:
+        out = ["Job ID          Name             User     Time Use S Queue",
+               "--------------- ---------------- -------- -------- - -----"]
+        for job_id, job in spool.active():
+            out.append("%-15s %-16s %-8s %8s %s batch" % (job_id + ".mock",
+                job["name"][:16], os.environ.get("USER", "mock"),
+                format_time(spool.cpu_time(job)), codes[spool.status(job)]))
+        return "\n".join(out) + "\n", "", 0
+
+    out, err, code = [], [], 0
+    for job_id in ids:
+        job = spool.find(job_id)
+        status = spool.status(job) if job else None
+        if job is None or (status in ("finished", "killed") and not history):
+            err.append("qstat: Unknown Job Id %s" % job_id)
+            code = 153
+            continue
+        if full:
+            out.append("Job Id: %s.mock" % job_id.split(".")[0])
+            out.append("    Job_Name = %s" % job["script"])
+            out.append("    job_state = %s" % codes[status])
+            out.append("    queue = batch")
+            out.append("    resources_used.cput = %s" % format_time(spool.cpu_time(job)))
+            if status == "killed":
+                out.append("    comment = Job deleted by user")
+            out.append("")
+        else:
+            out.append("%s.mock %s %s" % (job_id, job["name"], codes[status]))
+    return "\n".join(out) + "\n" if out else "", "\n".join(err) + "\n" if err else "", code
+
+
+def sge_qsub(spool, args):
+    scripts = [a for a in args if not a.startswith("-")]
+    if not scripts or not os.path.isfile(scripts[-1]):
+        return "", "Unable to read script file\n", 1
+    job_id = spool.submit(scripts[-1])
+    return 'Your job %s ("%s") has been submitted\n' % (job_id, os.path.basename(scripts[-1])), "", 0
+
+
+def sge_qstat(spool, args):
+    if "-g" in args:
+        return ("CLUSTER QUEUE                   CQLOAD   USED    RES  AVAIL  TOTAL\n"
+                "--------------------------------------------------------------------\n"
+                "all.q                             0.00    %4d      0    999   1000\n"
+                % len(spool.active())), "", 0
+
+    if "-j" in args:
+        ids = split_ids(args[args.index("-j") + 1:])
+        out, missing = [], []
+        for job_id in ids:
+            job = spool.find(job_id)
+            if job is None or spool.status(job) not in ("queued", "running"):
+                missing.append(job_id)
+                continue
+            out.append("=" * 62)
+            out.append("job_number:                 %s" % job_id)
+            out.append("job_name:                   %s" % job["script"])
+            out.append("cwd:                        %s" % job["dir"])
+            if spool.status(job) == "running":
+                out.append("usage         1:            cpu=%s, mem=0.00000 GB s, io=0.00000"
+                           % format_time(spool.cpu_time(job)))
+        if missing:
+            out.append("Following jobs do not exist: ")
+            out.append(", ".join(missing))
+        return "\n".join(out) + "\n", "", 1 if missing and len(missing) == len(ids) else 0
+
+    jobs = spool.active()
+    if not jobs:
+        return "", "", 0
+    out = ["job-ID  prior   name       user         state submit/start at     queue          slots ja-task-ID",
+           "-" * 100]
+    for job_id, job in jobs:
+        running = spool.status(job) == "running"
+        stamp = time.strftime("%m/%d/%Y %H:%M:%S",
+            time.localtime(job["started"] if running else job["submitted"]))
+        out.append("%7s 0.50000 %-10s %-12s %-5s %s %-14s %5d" % (job_id, job["name"][:10],
+            os.environ.get("USER", "mock")[:12], "r" if running else "qw", stamp,
+            "all.q@node01" if running else "", 1))
+    return "\n".join(out) + "\n", "", 0
+
+
+def qdel(spool, args):
+    out, err, code = [], [], 0
+    for job_id in split_ids([a for a in args if not a.startswith("-")]):
+        if spool.kill(job_id):
+            if os.environ.get("MOCK_SCHEDULER", "pbs") == "sge":
+                out.append("%s has registered the job %s for deletion"
+                           % (os.environ.get("USER", "mock"), job_id))
+        else:
+            err.append("qdel: Unknown Job Id %s" % job_id)
+            code = 153
+    return "\n".join(out) + "\n" if out else "", "\n".join(err) + "\n" if err else "", code
+
+
+def sbatch(spool, args):
+    scripts = [a for a in args if not a.startswith("-")]
+    if not scripts or not os.path.isfile(scripts[-1]):
+        return "", "sbatch: error: Unable to open file %s\n" % (scripts[-1] if scripts else ""), 1
+    return "Submitted batch job %s\n" % spool.submit(scripts[-1]), "", 0
+
+
+def slurm_state(spool, job):
+    return {"queued": "PENDING", "running": "RUNNING", "finished": "COMPLETED",
+            "killed": "CANCELLED by %d" % os.getuid()}[spool.status(job)]
+
+
+def sacct(spool, args):
+    ids, fields, parsable = [], ["jobid", "jobname", "state"], False
+    i = 0
+    while i < len(args):
+        arg = args[i]
+        if arg in ("-j", "--jobs") and i + 1 < len(args):
+            ids = split_ids([args[i + 1]])
+            i += 1
+        elif arg.startswith("-j"):
+            ids = split_ids([arg[2:]])
+        elif arg.startswith("--jobs="):
+            ids = split_ids([arg[7:]])
+        elif arg in ("-o", "--format") and i + 1 < len(args):
+            fields = args[i + 1].lower().split(",")
+            i += 1
+        elif arg.startswith("-o"):
+            fields = arg[2:].lower().split(",")
+        elif arg.startswith("--format="):
+            fields = arg[9:].lower().split(",")
+        elif arg in ("-P", "--parsable2"):
+            parsable = True
+        i += 1
+
+    out = []
+    for job_id in ids:
+        job = spool.find(job_id)
+        if job is None:
+            continue
+        values = {"jobid": job_id, "jobname": job["name"], "state": slurm_state(spool, job),
+                  "cputime": format_time(spool.cpu_time(job)),
+                  "elapsed": format_time(spool.cpu_time(job))}
+        row = [values.get(f, "") for f in fields]
+        out.append("|".join(row) if parsable else " ".join("%10s" % v for v in row))
+    return "\n".join(out) + "\n" if out else "", "", 0
+
+
+def scancel(spool, args):
+    for job_id in split_ids([a for a in args if not a.startswith("-")]):
+        spool.kill(job_id)
+    return "", "", 0
+
+
+def squeue(spool, args):
+    out = ["JOBID PARTITION     NAME     USER ST       TIME  NODES NODELIST(REASON)"]
+    for job_id, job in spool.active():
+        running = spool.status(job) == "running"
+        out.append("%5s     debug %8s %8s %2s %10s      1 %s" % (job_id, job["name"][:8],
+            os.environ.get("USER", "mock")[:8], "R" if running else "PD",
+            format_time(spool.cpu_time(job)), "node01" if running else "(Priority)"))
+    return "\n".join(out) + "\n", "", 0
+
+
+def sinfo(spool, args):
+    return ("PARTITION AVAIL  TIMELIMIT  NODES  STATE NODELIST\n"
+            "debug*       up   infinite     64   idle node[01-64]\n"), "", 0
+
+
+def run_command(name, args):
+    latency = env_float("MOCK_LATENCY", 0)
+    jitter = env_float("MOCK_JITTER", 0)
+    start = time.time()
+    if latency > 0 or jitter > 0:
+        time.sleep(max(0, latency + random.uniform(-jitter, jitter)))
+
+    flavour = os.environ.get("MOCK_SCHEDULER", "pbs").lower()
+    handlers = {
+        "qsub":    sge_qsub if flavour == "sge" else pbs_qsub,
+        "qstat":   sge_qstat if flavour == "sge" else pbs_qstat,
+        "qdel":    qdel,
+        "sbatch":  sbatch,
+        "sacct":   sacct,
+        "scancel": scancel,
+        "squeue":  squeue,
+        "sinfo":   sinfo,
+    }
+
+    spool = Spool()
+    try:
+        out, err, code = handlers[name](spool, args)
+        spool.save()
+        with open(os.path.join(spool.path, "calls.log"), "a") as log:
+            log.write(json.dumps({"time": start, "command": name, "args": args,
+                "bytes": len(out) + len(err), "exit": code,
+                "elapsed": time.time() - start}) + "\n")
+    finally:
+        spool.close()
+
+    write_throttled(sys.stdout, out)
+    sys.stderr.write(err)
+    return code
+
+
+def write_throttled(stream, text):
+    bandwidth = env_float("MOCK_BANDWIDTH", 0)
+    if bandwidth <= 0:
+        stream.write(text)
+        return
+    chunk = max(1, int(bandwidth / 10))
+    for i in range(0, len(text), chunk):
+        stream.write(text[i:i + chunk])
+        stream.flush()
+        time.sleep(len(text[i:i + chunk]) / bandwidth)
+
+
+#------------------------------------------------------------------------
+# Reporting
+#------------------------------------------------------------------------
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(p * len(values)))]
+
+
+def print_latency_table(title, samples):
+    print(title)
+    print("   %-28s %7s %10s %9s %9s %9s" % ("", "calls", "bytes", "mean ms", "p95 ms", "max ms"))
+    for key in sorted(samples):
+        times = [t for t, _ in samples[key]]
+        nbytes = sum(b for _, b in samples[key])
+        print("   %-28s %7d %10d %9.1f %9.1f %9.1f" % (key[:28], len(times), nbytes,
+            1000 * sum(times) / len(times), 1000 * percentile(times, 0.95), 1000 * max(times)))
+
+
+def report():
+    path = os.path.join(spool_dir(), "calls.log")
+    samples = {}
+    try:
+        with open(path) as log:
+            for line in log:
+                try:
+                    call = json.loads(line)
+                except ValueError:
+                    continue
+                samples.setdefault(call["command"], []).append((call["elapsed"], call["bytes"]))
+    except IOError:
+        print("No calls logged in", path)
+        return 1
+
+    total = sum(len(s) for s in samples.values())
+    print("Scheduler calls logged in", path)
+    print_latency_table("", samples)
+    print("   %-28s %7d" % ("total", total))
+
+    spool = Spool()
+    try:
+        jobs = spool.state["jobs"]
+        if jobs:
+            counts = {}
+            for job in jobs.values():
+                status = spool.status(job)
+                counts[status] = counts.get(status, 0) + 1
+            print("\nJobs:", ", ".join("%d %s" % (n, s) for s, n in sorted(counts.items())))
+            print("Calls per job: %.1f" % (total / float(len(jobs))))
+        spool.save()
+    finally:
+        spool.close()
+    return 0
+
+
+def reset():
+    path = spool_dir()
+    for name in ("jobs.json", "calls.log"):
+        try:
+            os.remove(os.path.join(path, name))
+        except OSError:
+            pass
+    return 0
+
+
+def install(directory):
+    os.makedirs(directory, exist_ok=True)
+    target = os.path.abspath(__file__)
+    for name in COMMANDS:
+        link = os.path.join(directory, name)
+        if os.path.lexists(link):
+            os.remove(link)
+        os.symlink(target, link)
+    print("Installed", ", ".join(COMMANDS), "in", directory)
+    return 0
+
+
+def main():
+    name = os.path.basename(sys.argv[0])
+    if name in COMMANDS:
+        return run_command(name, sys.argv[1:])
+
+    parser = argparse.ArgumentParser(description="Mock batch scheduler for IQmol")
+    parser.add_argument("--install", metavar="DIR",
+        help="create the scheduler command links in DIR")
+    parser.add_argument("--report", action="store_true",
+        help="summarize the calls logged in MOCK_SPOOL")
+    parser.add_argument("--reset", action="store_true",
+        help="remove the job table and call log from MOCK_SPOOL")
+    options = parser.parse_args()
+
+    if options.install:
+        return install(options.install)
+    if options.reset:
+        return reset()
+    if options.report:
+        return report()
+    parser.print_help()
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
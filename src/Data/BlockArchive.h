@@ -0,0 +1,134 @@
+#ifndef IQMOL_DATA_BLOCKARCHIVE_H
+#define IQMOL_DATA_BLOCKARCHIVE_H
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <QFile>
+#include <QString>
+#include <QByteArray>
+#include <vector>
+
+
+namespace IQmol {
+namespace Data {
+
+   /// The binary IQmol archive is a container of independently compressed
+   /// blocks.  Block 0 holds the text archive of the object structure, and
+   /// large arrays (grids, matrices and mesh buffers) are written out of line
+   /// as raw little-endian blocks that the text archive refers to by index.
+   ///
+   ///   Header:  char[8] magic, uint32 version, uint32 nBlocks, 
+   ///            uint64 table offset, uint64 reserved
+   ///   Blocks:  stored back to back 
+   ///   Table:   nBlocks x { uint64 offset, uint64 storedSize, uint64 size,
+   ///            uint32 codec, uint32 reserved }
+   namespace BlockArchive {
+      enum Codec { Raw = 0, Zstd = 1 };
+      unsigned const Version = 1;
+      bool isBlockArchive(QString const& filePath);
+   }
+
+
+   /// Collects the blocks while a Bank is serialized.  The array routines in
+   /// Serialization.h write to the current writer, if there is one, for the
+   /// lifetime of the object.
+   class BlockWriter {
+
+      public:
+         BlockWriter();
+         ~BlockWriter();
+
+         static BlockWriter* current();
+
+         /// Returns the index of the new block
+         unsigned append(QByteArray const& data);
+         unsigned append(double const* data, size_t const n);
+         unsigned append(int const* data, size_t const n);
+
+         /// Compresses the blocks in parallel and writes the container, with
+         /// the given metadata as block 0.
+         bool save(QString const& filePath, QByteArray const& metadata);
+
+         QString const& errorString() const { return m_error; }
+
+      private:
+         BlockWriter(BlockWriter const&) = delete;
+         BlockWriter& operator=(BlockWriter const&) = delete;
+
+         BlockWriter* m_previous;
+         std::vector<QByteArray> m_blocks;
+         QString m_error;
+   };
+
+
+   /// Provides access to the blocks of an archive file, which are only
+   /// decompressed when first requested, together with the blocks that
+   /// follow it.  Once opened, the array routines in Serialization.h read
+   /// from the current reader for the lifetime of the object.
+   class BlockReader {
+
+      public:
+         BlockReader();
+         ~BlockReader();
+
+         static BlockReader* current();
+
+         bool open(QString const& filePath);
+         unsigned nBlocks() const { return m_table.size(); }
+
+         /// Returns an empty array on error
+         QByteArray block(unsigned const index);
+
+         /// These fail if the block does not hold exactly n values
+         bool read(unsigned const index, double* data, size_t const n);
+         bool read(unsigned const index, int* data, size_t const n);
+
+         QString const& errorString() const { return m_error; }
+
+      private:
+         BlockReader(BlockReader const&) = delete;
+         BlockReader& operator=(BlockReader const&) = delete;
+
+         struct Entry {
+            quint64  offset;
+            quint64  storedSize;
+            quint64  size;
+            quint32  codec;
+            bool     loaded;
+            QByteArray data;
+         };
+
+         bool decompress(Entry&);
+         void decompressFrom(unsigned const index);
+         void release(unsigned const index);
+
+         bool m_active;
+         BlockReader* m_previous;
+         QFile m_file;
+         uchar* m_map;
+         std::vector<Entry> m_table;
+         QString m_error;
+   };
+
+} } // end namespace IQmol::Data
+
+#endif
@@ -37,6 +37,10 @@ namespace Data {
          CubeData(Geometry const& geometry, GridSize const& size, SurfaceType const& type, 
            QList<double> const& data) : GridData(size, type, data), m_geometry(geometry) { }
 
+         /// Allocates the grid, which is then filled in place via data().
+         CubeData(Geometry const& geometry, GridSize const& size, SurfaceType const& type)
+           : GridData(size, type), m_geometry(geometry) { }
+
          CubeData() { }  // for boost::serialize;
 
          Geometry const& geometry() const { return m_geometry; }
@@ -24,6 +24,7 @@
 
 #include "DataList.h"
 #include "SurfaceType.h"
+#include <functional>
 
 
 namespace IQmol {
@@ -38,7 +39,7 @@ namespace Data {
       public:
          Type::ID typeID() const { return Type::Density; }
 
-         Density() { }
+         Density() : m_nBasis(0), m_square(false) { }
 
          Density(SurfaceType const& surfaceType, QList<double> const& vectorElements,
             QString const& label = QString(), bool square = false);
@@ -51,7 +52,15 @@ namespace Data {
 
          QString const& label() const { return m_label; }
 
-         Vector* vector() { return &m_elements; }
+         /// Reads the (square or triangular) elements from their source,
+         /// returning false on failure.
+         typedef std::function<bool(QList<double>&)> ElementLoader;
+
+         /// Defers reading the elements until the vector is first accessed.
+         /// The density should have been constructed with an empty list.
+         void deferElements(unsigned const nElements, ElementLoader const&);
+
+         Vector* vector() { loadElements(); return &m_elements; }
 
          void serialize(InputArchive& ar, unsigned const version = 0) 
          {
@@ -60,12 +69,16 @@ namespace Data {
 
          void serialize(OutputArchive& ar, unsigned const version = 0) 
          {
+            loadElements();
             privateSerialize(ar, version);
          }
 
          void dump() const;
 
       private:
+         void setElements(QList<double> const&);
+         void loadElements();
+
          template <class Archive>
          void privateSerialize(Archive& ar, unsigned const /* version */) 
          {
@@ -79,6 +92,8 @@ namespace Data {
          QString     m_label;
          unsigned    m_nBasis;
          Vector      m_elements;
+         bool        m_square;
+         ElementLoader m_loader;
    };
 
 
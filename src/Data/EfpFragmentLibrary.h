@@ -23,6 +23,7 @@
 ********************************************************************************/
 
 #include "Data.h"
+#include <mutex>
 
 
 namespace IQmol {
@@ -71,6 +72,11 @@ namespace Data {
       private:
          static void checkOut();
 
+         // Files are parsed on worker threads (see Parser::ParseFile) and both
+         // the EFP and Q-Chem output parsers add to the library, so access to
+         // the maps is serialized.  The lock is recursive as add() parses the
+         // library file, which adds the fragment through this class.
+         static std::recursive_mutex s_mutex;
          static EfpFragmentLibrary* s_instance;
          static QMap<QString, Geometry*> s_geometries;
 		 // Only parameters for fragments not in the standard library are
@@ -79,6 +85,7 @@ namespace Data {
 
          template <class Archive>
          void privateSerialize(Archive& ar, unsigned const /* version */) {
+            std::lock_guard<std::recursive_mutex> lock(s_mutex);
             ar & s_geometries;
             ar & s_parameters;
          }
@@ -23,11 +23,14 @@
 ********************************************************************************/
 
 #include "Geometry.h"
+#include <memory>
 
 
 namespace IQmol {
 namespace Data {
 
+   class TrajectoryFile;
+
    class GeometryList : public List<Geometry> {
 
       public:
@@ -53,15 +56,36 @@ namespace Data {
 
          virtual void serialize(OutputArchive& ar, unsigned int const version = 0) 
          {
+            if (isMapped()) materialize();
             serializeList(ar, version);
             ar & m_defaultIndex;
          }
 
          void dump() const;
 
+		 /// Backs the list with a memory mapped TrajectoryFile rather than
+		 /// holding each Geometry on the heap.  Frames are only decoded when
+		 /// requested via frame() or coordinates().
+         bool setTrajectoryFile(QString const& filePath, QString* error = 0);
+         bool isMapped() const { return m_trajectory.get() != 0; }
+
+         /// Number of frames, whether mapped or held in the list
+         unsigned nFrames() const;
+         double energy(unsigned const index) const;
+         QList<qglviewer::Vec> coordinates(unsigned const index) const;
+
+		 /// For mapped lists this returns a single cached Geometry that is
+		 /// overwritten by the next call, so at most one frame is resident.
+         Geometry* frame(unsigned const index);
+
       private:
+         /// Decodes all the mapped frames into the list, used when saving.
+         void materialize();
+
          unsigned m_defaultIndex; 
          QString m_label;
+         std::shared_ptr<TrajectoryFile> m_trajectory;
+         std::shared_ptr<Geometry> m_frame;
    };
 
 } } // end namespace IQmol::Data
@@ -71,6 +71,8 @@ namespace Data {
 
          double maxR() const;
 
+         /// Writes the grid in cube format, compressed if the file name ends 
+         /// in .gz or .zst (see Util::CompressedFile).
          bool saveToCubeFile(QString const& filePath, QStringList const& coordinates,
             bool const invertSign) const;
            
@@ -89,6 +91,11 @@ namespace Data {
             return m_data[i][j][k];
          }
 
+         /// Contiguous access to the grid values, which are stored with the 
+         /// z index varying fastest (the same order as cube files).
+         double* data() { return m_data.data(); }
+         double const* data() const { return m_data.data(); }
+
 		 /// Performs a tri-linear interpolation of the grid data at each of 
 		 /// the 8 nearest grid points about (x,y,z). Returns 0 outside the 
          /// range of the grid
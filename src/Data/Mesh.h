@@ -84,6 +84,9 @@ namespace Data {
          Vertex addVertex(double const x, double const y, double const z);
          Face   addFace(Vertex const& v0, Vertex const& v1, Vertex const& v2);
 
+         /// Preallocates storage when the final size of the mesh is known.
+         void reserve(unsigned const nVertices, unsigned const nFaces);
+
          void setNormal(Vertex const& handle, double dx, double dy, double dz);
          void setNormal(Vertex const& handle, Normal const& normal);
          void setPoint(Vertex const& handle, Point const& p);
@@ -25,6 +25,7 @@
 #include "Data/Data.h"
 #include "Data/ShellList.h"
 #include "Math/Matrix.h"
+#include <functional>
 
 namespace IQmol {
 namespace Data {
@@ -46,6 +47,11 @@ namespace Data {
 
          static QString toString(OrbitalType const);
 
+         /// Reads the alpha and beta coefficients from their source, returning
+         /// false on failure.
+         typedef std::function<bool(QList<double>& alpha, QList<double>& beta)> 
+            CoefficientLoader;
+
          // Required for serialization
          Orbitals() : m_orbitalType(Undefined), m_nBasis(0), m_nOrbitals(0),
             m_restricted(false) { }
@@ -58,6 +64,13 @@ namespace Data {
             QList<double> const& betaCoefficients,
             QString const& title = QString());
 
+         /// Defers reading the coefficients until they are first accessed.
+         /// This should be called on orbitals constructed with empty 
+         /// coefficient lists, with the number of values the loader will 
+         /// return so that the dimensions are known up front.
+         void deferCoefficients(unsigned const nAlphaValues, 
+            unsigned const nBetaValues, CoefficientLoader const&);
+
          OrbitalType orbitalType() const { return m_orbitalType; }
 
          unsigned nBasis() const { return m_nBasis; }
@@ -88,6 +101,7 @@ namespace Data {
          // Reorders the coefficients from QChem to FChk/Molden order.  
          void reorderFromQChem()
          {
+             loadCoefficients();
              reorderFromQChem(m_alphaCoefficients);
              if (!m_restricted) reorderFromQChem(m_betaCoefficients);
          }
@@ -99,6 +113,7 @@ namespace Data {
  
          void serialize(OutputArchive& ar, unsigned const version = 0)
          {
+            loadCoefficients();
             privateSerialize(ar, version);
          }
 
@@ -115,6 +130,11 @@ namespace Data {
       protected:
          // Reorders the coefficients from QChem to FChk order.  
          void reorderFromQChem(Matrix&);
+         void setCoefficients(QList<double> const& alphaCoefficients, 
+            QList<double> const& betaCoefficients);
+         // Materializes deferred coefficients, a no-op if there are none.
+         // This is thread safe and checks the orthonormality once loaded.
+         void loadCoefficients() const;
          bool areOrthonormal() const;
 
          template <class Archive>
@@ -139,6 +159,7 @@ namespace Data {
          ShellList   m_shellList;
          Matrix      m_alphaCoefficients;
          Matrix      m_betaCoefficients;
+         mutable CoefficientLoader m_loader;
          //SurfaceList   m_surfaceList;
    };
 
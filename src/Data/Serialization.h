@@ -40,6 +40,7 @@
 #endif
 #include <exception>
 #include "Math/Matrix.h"
+#include "Data/BlockArchive.h"
 
 
 namespace boost {
@@ -82,6 +83,13 @@ inline void save(Archive& ar, const IQmol::Array3D& m, const unsigned /* version
 
    ar << s0 << s1 << s2;
 
+   // Binary archives hold the data in a separate block
+   if (IQmol::Data::BlockWriter* writer = IQmol::Data::BlockWriter::current()) {
+      unsigned block(writer->append(m.data(), m.num_elements()));
+      ar << block;
+      return;
+   }
+
    for (size_t i = 0; i < s0; ++i) {
        for (size_t j = 0; j < s1; ++j) {
            for (size_t k = 0; k < s2; ++k) {
@@ -101,6 +109,15 @@ inline void load(Archive& ar, IQmol::Array3D& m, unsigned const /* version */)
 
    IQmol::Array3D::extent_gen extents;
    m.resize(extents[s0][s1][s2]);
+
+   if (IQmol::Data::BlockReader* reader = IQmol::Data::BlockReader::current()) {
+      unsigned block;
+      ar >> block;
+      if (!reader->read(block, m.data(), m.num_elements())) {
+         throw std::runtime_error("Invalid grid data block in archive");
+      }
+      return;
+   }
    
    for (size_t i = 0; i < s0; ++i) {
        for (size_t j = 0; j < s1; ++j) {
@@ -129,6 +146,14 @@ inline void save(Archive& ar, const IQmol::Matrix& m, const unsigned /* version
    ar << nRow;
    ar << nCol;
 
+   // Binary archives hold the data in a separate block, ublas matrices are
+   // row major by default so the order is the same as the loop below.
+   if (IQmol::Data::BlockWriter* writer = IQmol::Data::BlockWriter::current()) {
+      unsigned block(writer->append(m.data().begin(), nRow*nCol));
+      ar << block;
+      return;
+   }
+
    for (size_t i = 0; i < nRow; ++i) {
        for (size_t j = 0; j < nCol; ++j) {
            ar << m(i,j);
@@ -145,7 +170,16 @@ inline void load(Archive& ar, IQmol::Matrix& m, unsigned const /* version */)
    ar >> nRow;
    ar >> nCol;
 
-   m.resize(nCol, nRow);
+   m.resize(nRow, nCol);
+
+   if (IQmol::Data::BlockReader* reader = IQmol::Data::BlockReader::current()) {
+      unsigned block;
+      ar >> block;
+      if (!reader->read(block, m.data().begin(), nRow*nCol)) {
+         throw std::runtime_error("Invalid matrix block in archive");
+      }
+      return;
+   }
 
    for (size_t i = 0; i < nRow; ++i) {
        for (size_t j = 0; j < nCol; ++j) {
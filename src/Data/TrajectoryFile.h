@@ -0,0 +1,100 @@
+#ifndef IQMOL_DATA_TRAJECTORYFILE_H
+#define IQMOL_DATA_TRAJECTORYFILE_H
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "QGLViewer/vec.h"
+#include <QFile>
+#include <QList>
+
+
+namespace IQmol {
+namespace Data {
+
+   class Geometry;
+   class GeometryList;
+
+   /// Compact binary store for long geometry lists (scans, AIMD runs).  The
+   /// file is memory mapped on opening and only the header and frame index
+   /// are read, individual frames are decoded on request.  This means large
+   /// trajectories open instantly and the resident memory does not depend
+   /// on the number of frames.
+   ///
+   /// All values are little endian:
+   ///    char[8]  "IQTRAJ01"
+   ///    quint32  nAtoms
+   ///    quint32  nFrames
+   ///    qint32   charge
+   ///    quint32  multiplicity
+   ///    quint32  atomic numbers[nAtoms]
+   ///    index[nFrames]  { quint64 offset; double energy; }
+   ///    frames[nFrames] { double coordinates[3*nAtoms]; }
+   class TrajectoryFile {
+
+      public:
+         TrajectoryFile();
+         ~TrajectoryFile();
+
+         /// Maps the file and reads the header and frame index.  Returns
+         /// false if the file could not be mapped or is inconsistent.
+         bool open(QString const& filePath);
+         void close();
+
+         bool isOpen() const { return m_data != 0; }
+         QString const& error() const { return m_error; }
+         QString filePath() const { return m_file.fileName(); }
+
+         unsigned nAtoms() const { return m_nAtoms; }
+         unsigned nFrames() const { return m_nFrames; }
+         int charge() const { return m_charge; }
+         unsigned multiplicity() const { return m_multiplicity; }
+         QList<unsigned> const& atomicNumbers() const { return m_atomicNumbers; }
+
+         /// These read directly from the mapped index and frame data
+         double energy(unsigned const frame) const;
+         QList<qglviewer::Vec> coordinates(unsigned const frame) const;
+
+         /// Writes the list to filePath in the above format.  All the
+         /// geometries must contain the same atoms.
+         static bool write(QString const& filePath, GeometryList const&, 
+            QString* error = 0);
+
+         static char const* Magic;
+
+      private:
+         uchar const* indexEntry(unsigned const frame) const;
+
+         QFile m_file;
+         uchar* m_data;
+         qint64 m_size;
+         uchar const* m_index;
+         unsigned m_nAtoms;
+         unsigned m_nFrames;
+         int m_charge;
+         unsigned m_multiplicity;
+         QList<unsigned> m_atomicNumbers;
+         QString m_error;
+   };
+
+} } // end namespace IQmol::Data
+
+#endif
@@ -47,9 +47,11 @@ namespace IQmol {
          void deleteGrid();
          void exportCubeFilePositive() { exportCubeFile(false); }
          void exportCubeFileNegative() { exportCubeFile(true); }
+         void exportCubeFileGzip() { exportCubeFile(false, ".cube.gz"); }
+         void exportCubeFileZstd() { exportCubeFile(false, ".cube.zst"); }
 
       private:
-         void exportCubeFile(bool const invertSign);
+         void exportCubeFile(bool const invertSign, QString const& suffix = ".cube");
         Data::GridDataList* m_gridDataList;
         QString m_moleculeName;
         QStringList m_coordinates;
@@ -69,9 +69,6 @@ namespace Layer {
          static void setVibrationVectorScale(GLfloat const& scale) { 
             s_vibrationVectorScale = scale; 
          }
-         static void setVibrationAmplitude(GLfloat const& amplitude) {
-            s_vibrationAmplitude  = amplitude; 
-         }
          static void setDisplayVibrationVector(bool const tf) {
             s_vibrationDisplayVector= tf; 
          }
@@ -124,11 +121,16 @@ namespace Layer {
          void setDisplacement(qglviewer::Vec const& displacement) { 
             m_displacement = displacement; 
          }
+         /// Scales the displacement vector when drawing, this is driven by
+         /// the animator of the mode being played on this atom's molecule.
+         void setVibrationAmplitude(GLfloat const amplitude) {
+            m_vibrationAmplitude = amplitude; 
+         }
 
       protected:
          unsigned int m_atomicNumber;
          qglviewer::Vec displacedPosition() {
-            return getPosition() + s_vibrationAmplitude * m_displacement;
+            return getPosition() + m_vibrationAmplitude * m_displacement;
          }
          GLfloat m_color[4];
          QString symbol() { return m_symbol; }
@@ -148,7 +150,6 @@ namespace Layer {
          static GLfloat s_radiusBallsAndSticks; // Default tube radius in angstroms
          static GLfloat s_radiusWireFrame;      // Default wire frame radius in pixels
          static GLfloat s_radiusTubes;          // Default tube radius in angstroms
-         static GLfloat s_vibrationAmplitude;   // determines the animation amplitude
          static GLfloat s_vibrationVectorScale; // scales all the lengths of the vectors
          static GLfloat s_vibrationVectorColor[];
          static bool    s_vibrationDisplayVector; 
@@ -170,6 +171,7 @@ namespace Layer {
          int     m_valency;
          int     m_hybridization;
          qglviewer::Vec m_displacement;
+         GLfloat m_vibrationAmplitude;
    };
 
    
@@ -22,6 +22,9 @@ const double arrowWidth = 2.0f;
 const double arrowHeight = 0.5f;
 const double tubeSize = 0.35f;
 
+// Chains shorter than this are meshed on the calling thread
+const int minSegmentsPerBlock = 64;
+
 
 
 Mesh createChainMesh(Data::ProteinChain const&);
@@ -62,6 +62,8 @@ namespace Layer {
          void resetGeometry();
          void makeAnimators();
          void cloneLastGeometry();
+         /// Takes ownership of the geometry, used to follow running jobs.
+         void appendGeometry(Data::Geometry*);
 
       protected:
          void setPlay(bool const play);
@@ -72,6 +74,7 @@ namespace Layer {
 
       private Q_SLOTS:
          void removeGeometry();
+         void saveTrajectory();
 
       private:
          void deleteAnimators();
@@ -36,6 +36,7 @@
 
 #include <QMap>
 #include <QFileInfo>
+#include <QTimer>
 
 #include <functional>
 
@@ -69,6 +70,7 @@ namespace IQmol {
       class Surface;
       class Group;
       class Charge;
+      class SymmetryDetector;
 
       typedef QMap<OpenBabel::OBAtom*, Atom*>  AtomMap;
       typedef QMap<OpenBabel::OBBond*, Bond*>  BondMap;
@@ -118,6 +120,11 @@ bool save(bool prompt = false);
 
             void symmetrize(double tolerance, bool updateCoordinates = true);
 
+			/// Returns a task that determines the point group of the visible
+			/// atoms for each of the tolerances.  The task is not started and
+			/// the caller takes ownership.
+            SymmetryDetector* createSymmetryDetector(QList<double> const& tolerances);
+
             static void toggleAutoDetectSymmetry() 
             { 
                s_autoDetectSymmetry = !s_autoDetectSymmetry; 
@@ -233,12 +240,19 @@ bool save(bool prompt = false);
             void selectAll();
             void selectAtoms(QList<int> const& indices);
             void createGeometryList();
+            /// Adds a geometry read from the output of a running job to the
+            /// end of the geometry list, creating the list if required. 
+            /// Ownership of the geometry passes to the Molecule.
+            void appendGeometry(Data::Geometry*);
 
             void openSurfaceAnimator();
 
             /// Passes the remove signal on so that the ViewerModel can deal with it
             void removeMolecule() { Component::removeMolecule(this); }
+            /// Point group detection runs in the background and the result
+            /// is signalled via pointGroupAvailable().
             void detectSymmetry();
+            /// Debounced, so a burst of edits results in a single detection.
             void autoDetectSymmetry();
             void invalidateSymmetry();
             void saveToCurrentGeometry();
@@ -266,6 +280,7 @@ bool save(bool prompt = false);
    
          private Q_SLOTS:
             void dumpData() { m_bank.dump(); }
+            void symmetryDetected();
             void setAtomicCharges(Data::Type::ID type);
             void updateAtomicCharges();
             void generateConformersDialog();
@@ -374,6 +389,10 @@ bool save(bool prompt = false);
             QAction* m_addGeometryMenu;;
 
             Matrix m_mullikenDecompositions;
+
+            QTimer m_symmetryTimer;
+            SymmetryDetector* m_symmetryDetector;
+            bool m_symmetryPending;
       };
    
    } // end namespace Layer
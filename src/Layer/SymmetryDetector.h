@@ -0,0 +1,71 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Util/Task.h"
+#include "QGLViewer/vec.h"
+#include <QStringList>
+#include <QByteArray>
+#include <vector>
+
+
+namespace IQmol {
+namespace Layer {
+
+   /// Determines the point group of a structure using SymMol in a separate 
+   /// thread.  Several tolerances can be evaluated in the one task and the 
+   /// results are cached on the structure and tolerance, so repeated requests
+   /// for an unchanged geometry (e.g. during editing) do not call SymMol.
+   class SymmetryDetector : public Task {
+
+      Q_OBJECT
+
+      public:
+         SymmetryDetector(QList<unsigned> const& atomicNumbers, 
+            QList<qglviewer::Vec> const& coordinates, QList<double> const& tolerances);
+
+         QList<double> const& tolerances() const { return m_tolerances; }
+
+         /// Returns the SymMol point group labels, one for each tolerance.
+         /// Only valid once the task has completed.
+         QStringList const& pointGroups() const { return m_pointGroups; }
+
+		 /// Synchronous evaluation of the point group.  On return the
+		 /// coordinates hold the symmetrized structure.  This is safe to call
+		 /// from any thread.
+         static QString pointGroup(std::vector<int> const& atomicNumbers, 
+            std::vector<double>& coordinates, double const tolerance);
+
+      protected:
+         void run();
+
+      private:
+         static QByteArray cacheKey(std::vector<int> const& atomicNumbers, 
+            std::vector<double> const& coordinates, double const tolerance);
+
+         std::vector<int> m_atomicNumbers;
+         std::vector<double> m_coordinates;
+         QList<double> m_tolerances;
+         QStringList m_pointGroups;
+   };
+
+} } // end namespace IQmol::Layer
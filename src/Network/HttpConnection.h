@@ -76,9 +76,14 @@ namespace Network {
          Reply* get(QString const& query) { return execute(query); }
          Reply* post(QString const& path, QString const&);
 
+         /// Limits the number of files HttpGetFiles downloads at once
+         int  maxConcurrentRequests() const { return m_maxConcurrentRequests; }
+         void setMaxConcurrentRequests(int const max) { m_maxConcurrentRequests = max; }
+
       protected:
          QNetworkAccessManager* m_networkAccessManager;
          bool m_secure; 
+         int m_maxConcurrentRequests;
 
       private:
          QString getJwt(QString const& userName);
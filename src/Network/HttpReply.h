@@ -36,6 +36,8 @@ typedef QMap<QString, QString> QStringMap;
 namespace IQmol {
 namespace Network {
 
+   class TransferManifest;
+
    class HttpReply : public Reply {
 
       Q_OBJECT
@@ -64,6 +66,9 @@ namespace Network {
 
          // This takes care of all the http:// crap
          void setUrl(QString const& path = QString()); 
+
+         /// Request for m_url carrying the headers and connection settings
+         QNetworkRequest newRequest() const;
  
       protected Q_SLOTS:
          void readToString();
@@ -99,6 +104,12 @@ namespace Network {
 
       private:
          QFile* m_file;
+         TransferManifest* m_manifest;
+         qint64 m_offset;
+         bool m_receiving;
+         /// Set if the server responded with neither the whole file nor the
+         /// requested range, in which case the file on disk is left as is.
+         bool m_rejected;
    };
 
 
@@ -117,8 +128,11 @@ namespace Network {
          void replyFinished();
 
       private:
+         void startPending();
+
          QStringList m_fileList;
          QString m_destinationPath;
+         QList<HttpGet*> m_pending;
          QList<HttpGet*> m_replies;
          int  m_totalReplies;
          bool m_allOk;
@@ -86,6 +86,25 @@ namespace Network {
          QString m_destinationPath;
    };
 
+
+   /// Copies each file in the list into the destination directory.
+   class LocalGetFiles : public LocalReply {
+
+      Q_OBJECT
+
+      public:
+         LocalGetFiles(LocalConnection* connection, QStringList const& fileList, 
+            QString const& destinationDirectory) : LocalReply(connection), 
+            m_fileList(fileList), m_destinationDirectory(destinationDirectory) { }
+
+      protected Q_SLOT:
+         void run();
+
+      private:
+         QStringList m_fileList;
+         QString m_destinationDirectory;
+   };
+
 } } // end namespace IQmol::Network
 
 #endif
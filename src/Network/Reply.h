@@ -24,6 +24,7 @@
 
 #include "QsLog.h"
 #include "NetworkException.h"
+#include <QByteArray>
 #include <QObject>
 #include <QDebug>
 
@@ -44,6 +45,9 @@ namespace Network {
          virtual ~Reply() { }
 
          QString message() const { return m_message; }
+         /// The output of an executed command exactly as it was received,
+         /// without the trimming and decoding applied to message().
+         QByteArray const& data() const { return m_data; }
          Status status() const { return m_status; }
          void start() { startSignal(); }
          void waitForFinish() { run(); }
@@ -66,6 +70,7 @@ namespace Network {
       protected:
          Status  m_status;
          QString m_message;
+         QByteArray m_data;
          bool    m_interrupt;
          int     m_totalReplies;
    };
@@ -26,24 +26,28 @@
 #define LIBSSH2_ERROR_AUTHENTICATION_CANCELLED -101
 
 #include "Connection.h"
+#include "SshReply.h"
+#include <QElapsedTimer>
 #include <libssh2.h>
+#include <atomic>
 
 
 namespace IQmol {
 namespace Network {
 
-   class SshReply;
    class SshExecute;
 
    class SshConnection : public Connection {
 
       Q_OBJECT
 
+      friend class SshReply;
       friend class SshExecute;
       friend class SshPutFile;
       friend class SshGetFile;
       friend class SftpPutFile;
       friend class SftpGetFile;
+      friend class SshGetArchive;
 
       public:
          SshConnection(QString const& hostname, int const port,
@@ -92,6 +96,15 @@ namespace Network {
       private:
          static unsigned s_numberOfConnections;
 
+         // Replies waiting to be run on the connection thread, see schedule()
+         QList<SshReply*> m_pending;
+         bool m_running;
+         QElapsedTimer m_yieldTimer;
+
+         void schedule(SshReply*);
+         void yield(SshReply::Priority const);
+         SshReply* takeNext(SshReply::Priority const lowest);
+
          int m_socket;
          LIBSSH2_AGENT* m_agent;
          QString m_username;
@@ -99,6 +112,7 @@ namespace Network {
          QString m_privateKeyFile;
          QString m_knownHostsFile;
          bool m_useSftp;
+         std::atomic<bool> m_archiveTransfers;
 
          void init();
          bool checkHost();
@@ -24,28 +24,58 @@
 
 #include "Reply.h"
 #include <QStringList>
+#include <libssh2.h>
+#include <memory>
+#include <vector>
 
 
 namespace IQmol {
 namespace Network {
 
    class SshConnection;
+   class TransferManifest;
 
    class SshReply : public Reply {
 
       Q_OBJECT
 
+      friend class SshConnection;
+
       public:
+         /// Control commands are run ahead of, and in between the blocks of,
+         /// bulk transfers queued on the same connection.
+         enum Priority { Control = 0, Bulk };
+
          SshReply(SshConnection*);
          virtual ~SshReply() { }
 
+         virtual Priority priority() const { return Control; }
+
       protected Q_SLOTS:
          void run();
 
       protected:
          static QString subEnv(QString const& command);
          virtual void runDelegate() = 0;
+
+         /// Emits copyProgress(double) only when the whole percentage changes
+         void reportProgress(qint64 const done, qint64 const total);
+
+         void getSftpFiles(QStringList const& sourcePaths, 
+            QStringList const& destinationPaths, bool const& getFilesInterrupt);
+
+         QString verifyChecksums(QStringList const& sourcePaths, 
+            QList<std::shared_ptr<TransferManifest>> const& manifests);
+
+         /// Returns the exit status of the command, or -1 if it could not
+         /// be run.
+         int remoteOutput(QString const& command, QString& output);
+
          SshConnection* m_connection;
+
+      private:
+         void runNow();
+         int m_percent;
    };
 
 
@@ -91,6 +121,8 @@ namespace Network {
             QString const& destinationPath) : SshReply(connection), 
             m_sourcePath(subEnv(sourcePath)), m_destinationPath(subEnv(destinationPath)) { }
 
+         Priority priority() const { return Bulk; }
+
       protected:
          void runDelegate();
 
@@ -109,6 +141,8 @@ namespace Network {
             QString const& destinationPath) : SshReply(connection), 
             m_sourcePath(subEnv(sourcePath)), m_destinationPath(subEnv(destinationPath)) { }
 
+         Priority priority() const { return Bulk; }
+
       protected:
          void runDelegate();
 
@@ -123,12 +157,15 @@ namespace Network {
       Q_OBJECT
 
       friend class SshGetFiles;
+      friend class SshGetArchive;
 
       public:
          SshGetFile(SshConnection* connection, QString const& sourcePath, 
             QString const& destinationPath) : SshReply(connection), m_getFilesInterrupt(false),
             m_sourcePath(subEnv(sourcePath)), m_destinationPath(subEnv(destinationPath)) { }
 
+         Priority priority() const { return Bulk; }
+
       protected:
          void runDelegate();
          void runDelegate(bool& getFilesInterrupt);
@@ -151,6 +188,8 @@ namespace Network {
             QString const& destinationPath) : SshReply(connection), m_getFilesInterrupt(false),
             m_sourcePath(subEnv(sourcePath)), m_destinationPath(subEnv(destinationPath)) { }
 
+         Priority priority() const { return Bulk; }
+
       protected:
          void runDelegate();
          void runDelegate(bool& getFilesInterrupt);
@@ -171,6 +210,8 @@ namespace Network {
             QString const& destinationDirectory) : SshReply(connection), 
             m_fileList(fileList), m_destinationDirectory(destinationDirectory) { }
 
+         Priority priority() const { return Bulk; }
+
       protected:
          void runDelegate();
 
@@ -189,12 +230,48 @@ namespace Network {
             QString const& destinationDirectory) : SshReply(connection), 
             m_fileList(fileList), m_destinationDirectory(destinationDirectory) { }
 
+         Priority priority() const { return Bulk; }
+
+      protected:
+         void runDelegate();
+
+      private:
+         QStringList m_fileList;
+         QString m_destinationDirectory;
+   };
+
+
+   /// Retrieves a set of files as a single compressed tar stream which is
+   /// extracted on the fly into the destination directory.  The remote side
+   /// runs tar piped through zstd, or gzip if zstd is not available.  If the
+   /// stream cannot be set up the files are copied individually instead.
+   class SshGetArchive : public SshReply {
+
+      Q_OBJECT
+
+      public:
+         SshGetArchive(SshConnection* connection, QStringList const& fileList, 
+            QString const& destinationDirectory) : SshReply(connection), 
+            m_fileList(fileList), m_destinationDirectory(destinationDirectory),
+            m_channel(0) { }
+
+         Priority priority() const { return Bulk; }
+
       protected:
          void runDelegate();
 
       private:
+         friend struct ArchiveReader;
+
+         QString archiveCommand() const;
+         void extractArchive(QStringList& extracted, QString& error);
+         void getFilesIndividually(QStringList const& fileList);
+         qint64 readChannel(void const** buffer, QString& error);
+
          QStringList m_fileList;
          QString m_destinationDirectory;
+         LIBSSH2_CHANNEL* m_channel;
+         std::vector<char> m_buffer;
    };
 
 
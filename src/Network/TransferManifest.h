@@ -0,0 +1,86 @@
+#ifndef IQMOL_NETWORK_TRANSFERMANIFEST_H
+#define IQMOL_NETWORK_TRANSFERMANIFEST_H
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <QCryptographicHash>
+#include <QStringList>
+
+
+namespace IQmol {
+namespace Network {
+
+   /// Sidecar record kept next to a partially downloaded file so that an
+   /// interrupted transfer can be continued rather than restarted.  The
+   /// remote size and version (e.g. modification time or ETag) identify what
+   /// is being fetched and a SHA-256 digest of each block allows the data
+   /// already on disk to be checked before it is trusted.
+   class TransferManifest {
+
+      public:
+         static qint64 const BlockSize;
+
+         TransferManifest(QString const& destinationPath);
+
+         /// Returns true if the manifest on disk refers to the given version
+         /// of the remote file.
+         bool matches(qint64 const size, QString const& version) const;
+
+         /// Checks the blocks of the local file against the manifest and
+         /// truncates the file after the last good one.  Returns the offset
+         /// from which the transfer should continue.
+         qint64 verify();
+
+         /// Starts a new transfer, discarding any local data.
+         void reset(qint64 const size, QString const& version);
+
+         /// Records data appended to the local file.  The manifest is saved
+         /// each time a block is completed.
+         void append(char const* data, qint64 size);
+
+         void save();
+
+         /// Removes the manifest once the transfer is complete.
+         void remove();
+
+         QString const& version() const { return m_version; }
+
+         /// Hex SHA-256 digest of everything appended so far.
+         QByteArray checksum() const;
+
+      private:
+         bool load();
+
+         QString m_destinationPath;
+         QString m_manifestPath;
+         qint64 m_size;
+         QString m_version;
+         QList<QByteArray> m_blocks;
+
+         QCryptographicHash m_blockHash;
+         qint64 m_blockFill;
+         QCryptographicHash m_fileHash;
+   };
+
+} } // end namespace IQmol::Network
+
+#endif
@@ -50,13 +50,18 @@ namespace Parser {
    class Cube : public Base {
 
       public:
+		 /// The header is read line by line, but the grid data are parsed 
+		 /// straight out of the memory-mapped file in parallel chunks.
+         bool parseFile(QString const& filePath);
          bool parse(TextStream&);
          bool save(QString const& filePath, Data::Bank&);
 
       private:
+         bool parseHeader(TextStream& textStream);
          int parseGridAxes(TextStream& textStream);
 		 bool parseCoordinates(TextStream& textStream, unsigned nAtoms);
          void parseGridData(TextStream& textStream);
+         void parseGridData(char const* begin, char const* end);
          QStringList formatCoordinates(Data::Geometry const&);
 
          int m_nx, m_ny, m_nz;
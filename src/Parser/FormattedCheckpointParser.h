@@ -42,9 +42,29 @@ namespace Parser {
    class FormattedCheckpoint : public Base {
 
       public:
+         FormattedCheckpoint() : m_deferArrays(false) { }
          bool parse(TextStream&);
 
+         /// Location of a real array in the file.  Large arrays (orbital 
+         /// coefficients and density matrices) are only indexed on the first
+         /// pass and read when the data are first required.
+         struct Section {
+            qint64   offset;
+            unsigned count;
+         };
+
+         typedef QList<Section> SectionList;
+
       private:
+         // Set when parsing from a file, which is required for deferred reads
+         bool m_deferArrays;
+
+         // Either reads the array into values or, if deferring, records its
+         // location in sections and skips over it.  The new array replaces 
+         // any existing data unless append is set.
+         void readDeferredArray(TextStream&, unsigned nTokens, QList<double>& values, 
+            SectionList& sections, bool const append = false);
+
          QList<int> readIntegerArray(TextStream&, unsigned nTokens);
          QList<double> readDoubleArray(TextStream&, unsigned nTokens);
          QList<unsigned> readUnsignedArray(TextStream&, unsigned nTokens);
@@ -72,6 +92,8 @@ namespace Parser {
             QList<double> betaCoefficients;
             QList<double> alphaEnergies;
             QList<double> betaEnergies;
+            SectionList   alphaSections;
+            SectionList   betaSections;
          };
 
          void clear(OrbitalData&);
@@ -28,7 +28,9 @@
 namespace IQmol {
 namespace Parser {
 
-   /// Parser for IQmol archive files which store compressed serialized data.
+   /// Parser for IQmol archive files which store serialized data.  Files are
+   /// written as binary block archives (see Data/BlockArchive.h), the older
+   /// plain text archives can still be read.
    class IQmol : public Base {
 
       public:
@@ -37,6 +39,9 @@ namespace Parser {
 
          // This is not implemented as it shouldn't ever be required.
          bool parse(TextStream&) { return false; }
+
+      private:
+         bool parseBlockArchive(QString const& filePath);
    };
 
 } } // end namespace IQmol::Parser
@@ -0,0 +1,64 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <QString>
+#include <vector>
+
+
+namespace IQmol {
+namespace Parser {
+
+   /// Aho-Corasick automaton for finding which of a fixed set of keywords
+   /// occur in a line, using a single pass over the characters regardless of
+   /// the number of keywords.  Keywords must be ASCII; any other character
+   /// in a line simply resets the match.
+   class KeywordMatcher {
+
+      public:
+         KeywordMatcher() : m_compiled(false) { }
+
+         /// Several keywords may share the same id.
+         void add(QString const& keyword, int const id);
+
+         /// Builds the automaton, this must be called after the last add().
+         void compile();
+
+         /// Fills ids with those of the keywords found in line, in ascending
+         /// order without repeats.
+         void match(QString const& line, std::vector<int>& ids) const;
+
+      private:
+         struct Keyword {
+            QString text;
+            int id;
+         };
+
+         bool m_compiled;
+         int m_nClasses;
+         unsigned char m_class[128];
+         std::vector<Keyword> m_keywords;
+         std::vector<int> m_delta;                // state transition table
+         std::vector<std::vector<int>> m_output;  // ids recognized in each state
+   };
+
+} } // end namespace IQmol::Parser
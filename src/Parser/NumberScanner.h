@@ -0,0 +1,183 @@
+#pragma once
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <QByteArray>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace IQmol {
+namespace Parser {
+namespace Scan {
+
+   /// Light-weight routines for pulling numbers out of raw character buffers,
+   /// such as memory-mapped files.  These avoid the QString round trip and
+   /// are independent of the C locale.
+
+   inline bool isSpace(char const c)
+   {
+      return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+   }
+
+
+   inline char const* skipSpace(char const* p, char const* end)
+   {
+      while (p < end && isSpace(*p)) ++p;
+      return p;
+   }
+
+
+   /// Returns the number of whitespace separated tokens in [begin, end).
+   inline size_t countTokens(char const* p, char const* end)
+   {
+      size_t count(0);
+      bool inToken(false);
+      for (; p < end; ++p) {
+          bool space(isSpace(*p));
+          if (!space && !inToken) ++count;
+          inToken = !space;
+      }
+      return count;
+   }
+
+
+   /// Parses a decimal integer starting at p, which is left pointing to the
+   /// first character after the number.  As with toDouble(), the number must
+   /// be followed by whitespace or the end of the buffer.
+   inline bool toInteger(char const*& p, char const* end, long long& value)
+   {
+      char const* q(p);
+      bool negative(false);
+
+      if (q < end && (*q == '-' || *q == '+')) {
+         negative = (*q == '-');
+         ++q;
+      }
+
+      char const* digits(q);
+      unsigned long long v(0);
+      for (; q < end && *q >= '0' && *q <= '9'; ++q) {
+          v = 10*v + (*q - '0');
+          if (v > (1ull << 62)) return false;
+      }
+
+      if (q == digits || (q < end && !isSpace(*q))) return false;
+
+      value = negative ? -(long long)v : (long long)v;
+      p = q;
+      return true;
+   }
+
+
+   /// Parses a floating point number starting at p, which is left pointing
+   /// to the first character after the number.  Numbers with up to 19
+   /// significant digits and a small exponent (which covers the fixed 
+   /// formats written by Q-Chem and most other programs) are converted 
+   /// exactly with a single multiplication or division, anything else is 
+   /// handed off to QByteArray::toDouble().  Fortran 'D' exponents are accepted.
+   inline bool toDouble(char const*& p, char const* end, double& value)
+   {
+      static double const powersOfTen[] = { 
+         1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+         1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+      char const* start(p);
+      char const* q(p);
+      bool negative(false);
+
+      if (q < end && (*q == '-' || *q == '+')) {
+         negative = (*q == '-');
+         ++q;
+      }
+
+      uint64_t mantissa(0);
+      int  significant(0);
+      int  exponent(0);
+      bool digits(false);
+      bool truncated(false);
+
+      for (; q < end && *q >= '0' && *q <= '9'; ++q) {
+          digits = true;
+          if (significant < 19) {
+             mantissa = 10*mantissa + (*q - '0');
+             if (mantissa) ++significant;
+          }else {
+             ++exponent;
+             truncated = truncated || *q != '0';
+          }
+      }
+
+      if (q < end && *q == '.') {
+         for (++q; q < end && *q >= '0' && *q <= '9'; ++q) {
+             digits = true;
+             if (significant < 19) {
+                mantissa = 10*mantissa + (*q - '0');
+                if (mantissa) ++significant;
+                --exponent;
+             }else {
+                truncated = truncated || *q != '0';
+             }
+         }
+      }
+
+      if (!digits) return false;
+
+      if (q < end && (*q == 'e' || *q == 'E' || *q == 'd' || *q == 'D')) {
+         char const* r(q+1);
+         bool negativeExponent(false);
+         if (r < end && (*r == '-' || *r == '+')) {
+            negativeExponent = (*r == '-');
+            ++r;
+         }
+         if (r >= end || *r < '0' || *r > '9') return false;
+         int e(0);
+         for (; r < end && *r >= '0' && *r <= '9'; ++r) {
+             if (e < 100000) e = 10*e + (*r - '0');
+         }
+         exponent += negativeExponent ? -e : e;
+         q = r;
+      }
+
+      // Numbers must be delimited by whitespace
+      if (q < end && !isSpace(*q)) return false;
+
+      if (!truncated && mantissa < (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+         value = (double)mantissa;
+         value = exponent < 0 ? value / powersOfTen[-exponent] 
+                              : value * powersOfTen[exponent];
+      }else {
+         QByteArray token(start, q-start);
+         token.replace('d', 'e').replace('D', 'e');
+         bool ok;
+         value = token.toDouble(&ok);
+         if (!ok) return false;
+         p = q;
+         return true;
+      }
+
+      if (negative) value = -value;
+      p = q;
+      return true;
+   }
+
+} } } // end namespace IQmol::Parser::Scan
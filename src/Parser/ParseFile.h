@@ -41,7 +41,8 @@ namespace Parser {
    /// if required.  If a directory is passed to the constructor, the
    /// directory is searched for all files with the same base name as the
    /// directory.  For example, if the directory is ~/Ethane, then we look
-   /// for all files of the form ~/Ethane/Ethane.* 
+   /// for all files of the form ~/Ethane/Ethane.*  The files are parsed
+   /// concurrently, but the data are merged in the order of the file list.
    class ParseFile : public Task {
 
       Q_OBJECT 
@@ -73,11 +74,12 @@ namespace Parser {
          /// what files to parse.
          void parseDirectory(QString const& path, QString const& filter);
 
-         /// Parses a file, returning false only if the file doesn't exist.
-         bool parse(QString const& filePath, bool& addToFileList);
+         /// Returns a new parser for the file, or 0 if there isn't one.  
+         /// addToFileList is set if the file should appear in the file list.
+         Base* createParser(QString const& filePath, bool& addToFileList);
 
-         /// Convenience function that runs a sub-parser over the file.
-         void runParser(Base* parser, QString const& filePath);
+         /// Collects the errors and data from a parser that has been run.
+         void mergeParser(Base* parser, bool const ok, QString const& filePath);
 
          QString     m_name;
          QString     m_filePath;
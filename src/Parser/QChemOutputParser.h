@@ -38,9 +38,12 @@ namespace Data {
 namespace Parser {
 
    struct DysonData;
+   class KeywordMatcher;
 
    class QChemOutput : public Base {
 
+      friend class QChemOutputTail;
+
       public:
          bool parse(TextStream&);
 
@@ -49,6 +52,24 @@ namespace Parser {
          static QStringList parseForErrors(TextStream&);
 
       private:
+         /// The sections of the output recognized by parse(), in the order
+         /// their triggers are tested.
+         enum Section {
+            WelcomeToQChem, FatalError, TimeLimit, UserInput,
+            StandardOrientation, FsmStart, OptimizerStart, OptimizerEnd,
+            FinalEnergy, PesScan, StringNodes, BasisSet, PointGroup, BetaElectrons,
+            FinalBasisEnergy, ScfEnergy, TotalEnergy, Rimp2Energy, RiMp2Energy,
+            SosMp2Energy, MosMp2Energy, TrimMp2Energy, Mp2VEnergy, Mp2Energy,
+            CcsdEnergy, CcdEnergy, Emp4Energy, EnergyIs, MullikenCharges,
+            ChelpgCharges, HirshfeldCharges, StewartCharges, LowdinCharges,
+            NaturalCharges, OrbitalSymmetries, OrbitalEnergies, TddftStates,
+            CisStates, CisdStates, NmrReference, NmrShifts, NmrCouplings,
+            Multipoles, PartialHessian, Hessian, VibrationalAnalysis, Dma,
+            Basis, Dyson, EffectiveRegion
+         };
+
+         static KeywordMatcher const& sectionMatcher();
+
          void readStandardCoordinates(TextStream&, Data::Geometry&);
          void readCharges(TextStream&, Data::Geometry&, Data::Type::ID);
          void readNBO(TextStream&, Data::Geometry&, Data::Type::ID);
@@ -0,0 +1,96 @@
+#ifndef IQMOL_PARSER_QCHEMOUTPUTTAIL_H
+#define IQMOL_PARSER_QCHEMOUTPUTTAIL_H
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "QChemOutputParser.h"
+
+
+namespace IQmol {
+
+namespace Data {
+   class Frequencies;
+   class Geometry;
+}
+
+namespace Parser {
+
+   /// Incremental parser for the output of a running Q-Chem job.  The
+   /// output is passed in as it grows, starting at offset(), and only the
+   /// sections that have been written in full are parsed.  A section that is
+   /// cut off is left unconsumed so it is re-read with the next chunk.  Only
+   /// the data needed to follow a job are extracted: geometries, energies,
+   /// frequencies and errors.  The complete output should still be parsed
+   /// with QChemOutput once the job has finished.
+   class QChemOutputTail {
+
+      public:
+         QChemOutputTail();
+         ~QChemOutputTail();
+
+         /// Parses the bytes of the file starting at offset().  If final is
+         /// true there is no more output to come and a trailing section is
+         /// parsed as is.  Returns false once parsing has stopped because 
+         /// the coordinates could not be read.
+         bool update(QByteArray const& data, bool const final = false);
+
+         /// The file offset from which the next chunk should be read.
+         qint64 offset() const { return m_offset; }
+
+         /// A geometry is released when the next one is found, so that it 
+         /// carries all its energies, or when the final chunk is parsed.
+         /// Geometries the optimizer repeats without an energy are dropped,
+         /// as in QChemOutput::parse().  Ownership passes to the caller.
+         QList<Data::Geometry*> takeGeometries();
+         /// The total energies in the order they appear in the output.
+         QList<double> takeEnergies();
+         QList<Data::Frequencies*> takeFrequencies();
+
+         QStringList const& errors() const { return m_errors; }
+
+      private:
+         enum Result { Ignored, Handled, Incomplete };
+
+         Result parseSection(int const section, QString const& line, 
+            TextStream&, bool const final);
+         Result readGeometry(QString const& line, TextStream&, bool const final);
+         void setEnergy(QString const& token);
+         void releaseCurrentGeometry();
+         void dropRepeatedGeometry();
+
+         QChemOutput m_reader;
+         qint64 m_offset;
+         bool   m_stop;
+         bool   m_isFSM;
+
+         Data::Geometry* m_firstGeometry;
+         Data::Geometry* m_currentGeometry;
+
+         QList<Data::Geometry*>    m_geometries;
+         QList<double>             m_energies;
+         QList<Data::Frequencies*> m_frequencies;
+         QStringList m_errors;
+   };
+
+} } // end namespace IQmol::Parser
+
+#endif
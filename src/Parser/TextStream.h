@@ -22,73 +22,42 @@
 ********************************************************************************/
 
 #include "Util/QtVersionHacks.h"
-//#include "Util/QsLog.h"
 #include <QStringList>
-#include <QTextStream>
+#include <QByteArray>
 #include <QIODevice>
+#include <QPointer>
 #include <QRegularExpression>
 
+class QFileDevice;
 
 
 namespace IQmol {
 namespace Parser {
 
-   /// A wrapper around an input QTextStream that adds some useful
-   /// functionality like line counting, seeking and tokenization.
-   class TextStream : public QTextStream {
+   /// Line-oriented reader used by the parsers that adds line counting, 
+   /// seeking and tokenization.  The contents are held as raw bytes: files
+   /// are memory mapped where possible, other devices and strings are read 
+   /// into a buffer up front.  Lines are only decoded (as UTF-8) when they 
+   /// are requested as QStrings, so skipping, seeking and numeric parsing 
+   /// work directly on the bytes.
+   class TextStream {
 
       public:
-         TextStream(QIODevice* device) : QTextStream(device), m_lineCount(0) 
-         {
-            if (!device->isOpen() || !device->isReadable()) {
-               throw std::runtime_error("TextStream unable to read device");
-            }
-         }
+         TextStream(QIODevice* device);
+         TextStream(QString* string);
+         ~TextStream();
 
-         TextStream(QString* string) : QTextStream(string, QIODevice::ReadOnly), 
-            m_lineCount(0) { }
-
-         QString const& nextLine() 
-         {
-            ++m_lineCount;
-            m_previousLine = readLine().trimmed();
-            return m_previousLine;
-         }
+         QString const& nextLine();
 
-         QString const& nextLineNonTrimmed() 
-         {
-            ++m_lineCount;
-            m_previousLine = readLine();
-            return m_previousLine;
-         }
+         QString const& nextLineNonTrimmed();
 
-         QString const& previousLine() 
-         {
-            return m_previousLine;
-         }
+         QString const& previousLine() const;
 
-        void skipBack(int n = 1)
-         {
-            //QLOG_DEBUG() << " Linecount is " << m_lineCount;
-            int oldlinecount = m_lineCount - n;
-
-            QTextStream::seek(0);
-            //QLOG_DEBUG() << readLine();
-            m_lineCount = 0;
-            //QLOG_DEBUG() << " Linecount is " << m_lineCount;
-            while((m_lineCount < oldlinecount )){
-               nextLine();
-            }
-         }
+         /// Steps back n lines by scanning backwards from the current 
+         /// position, so the cost is independent of the position in the file.
+         void skipBack(int n = 1);
 
-         QString const& nextNonEmptyLine() 
-         {
-            nextLine();
-            while (!atEnd() && m_previousLine.isEmpty()) {
-               nextLine();
-            }
-            return m_previousLine;
-         }
+         QString const& nextNonEmptyLine();
 
          QStringList nextLineAsTokens() 
          {
@@ -100,38 +69,29 @@ namespace Parser {
             return tokenize(nextNonEmptyLine());
          }
 
-         QList<double> nextLineAsDoubles() 
+         /// Returns the numerical tokens on the next line, tokens that do
+         /// not convert to a double are skipped.  The line is not decoded.
+         QList<double> nextLineAsDoubles();
+
+         /// Returns the next line, untrimmed and without the line terminator,
+         /// as a QByteArray that shares the stream's buffer.  It is only 
+         /// valid for the lifetime of the stream.
+         QByteArray nextRawLine();
+
+         /// As above, but without the QByteArray wrapper.  Both pointers are
+         /// null at the end of the stream.
+         void nextRawLine(char const*& begin, char const*& end)
          {
-             QStringList tokens(nextLineAsTokens());
-             QList<double> values;
-             double x;  bool ok;
-
-             for (int i = 0; i < tokens.size(); ++i) {
-                 x = tokens[i].toDouble(&ok);                 
-                 if (ok) values.append(x);
-             }
-             return values;
+            nextLineRaw();
+            begin = m_previousBegin;
+            end   = m_previousEnd;
          }
 
          // Returns the next line that contains the given string.
          QString const& seek(QString const& str, 
-            Qt::CaseSensitivity caseSensitive = Qt::CaseSensitive) 
-         {
-            nextLine();
-            while (!atEnd() && !m_previousLine.contains(str, caseSensitive)) {
-               nextLine();
-            }
-            return m_previousLine;
-         }
+            Qt::CaseSensitivity caseSensitive = Qt::CaseSensitive);
 
-         QString const& seek(QRegularExpression const& regExp) 
-         {
-            nextLine();
-            while (!atEnd() && !m_previousLine.contains(regExp)) {
-               nextLine();
-            }
-            return m_previousLine;
-         }
+         QString const& seek(QRegularExpression const& regExp);
 
          QStringList seekAndSplit(QString const& str,
             Qt::CaseSensitivity caseSensitive = Qt::CaseSensitive) 
@@ -144,10 +104,7 @@ namespace Parser {
             return tokenize(seek(regExp));
          }
 
-         void skipLine(int n = 1) 
-         {
-             for (int i = 0; i < n; ++i) { nextLine(); }
-         }
+         void skipLine(int n = 1);
 
          int  lineNumber() const { return m_lineCount; }
 
@@ -155,45 +112,44 @@ namespace Parser {
 		 /// line numbers need to be referenced to the parent TextStream.
          void setOffset(int const offset) { m_lineCount = offset; }
 
-         static QStringList tokenize(QString const& str) 
-         {
-            return str.split(QRegularExpression("\\s+"), IQmolSkipEmptyParts);
-         }
+         static QStringList tokenize(QString const& str);
 
-         QString const& nextBlock(QChar const open = '{', QChar const close = '}') 
-         {
-             int nested(0);
-             QChar c;
-             QString block;
-             
-             // keep going until we find our starting brace
-             while (!atEnd() && !nested) {
-                this->operator>>(c); 
-                block += c;
-                if (c == open) ++nested;
-
-             }
-
-             while (!atEnd() && nested) {
-                this->operator>>(c); 
-                block += c;
-                if (c == open)  ++nested;
-                if (c == close) --nested;
-             }
-   
-             // Not strictly correct, but conceptually consistent.
-             m_previousLine = block;
-             return m_previousLine;
-         }
+         QString const& nextBlock(QChar const open = '{', QChar const close = '}');
+
+         // The following mirror the QTextStream functions of the same name,
+         // they do not affect the line count.
+         bool atEnd() const { return m_pos >= m_size; }
+         qint64 pos() const { return m_base + m_pos; }
+         QString readLine();
+         QString readAll();
 
       private:
-         void rewind() { 
-            m_lineCount = 0;
-            seek(0); 
-         }
+         TextStream(TextStream const&) = delete;
+         TextStream& operator=(TextStream const&) = delete;
+
+         // Advances past the next line, setting [begin, end) to its contents
+         // minus the terminator.
+         void advance(char const*& begin, char const*& end);
+
+         // Reads the next line as the previous line without decoding it
+         void nextLineRaw();
+
+         qint64 countLines(qint64 from, qint64 to) const;
+
+         QPointer<QFileDevice> m_file;
+         uchar*      m_map;
+         QByteArray  m_buffer;
+         char const* m_data;
+         qint64      m_size;
+         qint64      m_pos;
+         qint64      m_base;
 
          int m_lineCount;
-         QString m_previousLine;
+         char const* m_previousBegin;
+         char const* m_previousEnd;
+         bool m_previousTrimmed;
+         mutable bool m_previousDecoded;
+         mutable QString m_previousLine;
    };
 
 } } // end namespace IQmol::Parser
@@ -38,6 +38,7 @@ namespace Process {
       Q_OBJECT
 
       friend class JobMonitor;
+      friend class JobStore;
       friend class Server;
 
       public:
@@ -0,0 +1,77 @@
+#ifndef IQMOL_PROCESS_JOBMODEL_H
+#define IQMOL_PROCESS_JOBMODEL_H
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Job.h"
+#include <QAbstractTableModel>
+#include <QHash>
+
+
+namespace IQmol {
+namespace Process {
+
+   /// Table model for the JobMonitor.  Values are read from the Jobs when the
+   /// view asks for them, so only the visible rows cost anything, and a Job
+   /// signalling an update only refreshes its own row.
+   class JobModel : public QAbstractTableModel {
+
+      Q_OBJECT
+
+      public:
+         enum Column { Name = 0, ServerName, SubmitTime, RunTime, Status, ColumnCount };
+
+         JobModel(QObject* parent = 0) : QAbstractTableModel(parent), m_runningJobs(0) { }
+
+         int rowCount(QModelIndex const& parent = QModelIndex()) const;
+         int columnCount(QModelIndex const& parent = QModelIndex()) const;
+         QVariant data(QModelIndex const& index, int role = Qt::DisplayRole) const;
+         QVariant headerData(int section, Qt::Orientation, int role = Qt::DisplayRole) const;
+
+         void append(Job*);
+         void remove(Job*);
+         bool contains(Job* job) const { return m_rows.contains(job); }
+
+         Job* job(QModelIndex const&) const;
+         JobList const& jobs() const { return m_jobs; }
+
+         /// True if any of the jobs has a run time that is ticking over
+         bool hasRunningJobs() const { return m_runningJobs > 0; }
+
+      public Q_SLOTS:
+         void update(Job*);
+
+      private Q_SLOTS:
+         void jobUpdated();
+
+      private:
+         JobList m_jobs;
+         QHash<Job*, int> m_rows;
+         QHash<Job*, bool> m_running;
+         int m_runningJobs;
+
+         void setRunning(Job*, bool const running);
+   };
+
+} } // end namespace IQmol::Process
+
+#endif
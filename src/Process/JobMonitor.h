@@ -23,7 +23,10 @@
 
 #include "ui_JobMonitor.h"
 #include "Job.h"
+#include "JobModel.h"
 
+#include <QMap>
+#include <QSet>
 #include <QTimer>
 
 
@@ -31,8 +34,14 @@ class QCloseEvent;
 class QShowEvent;
 
 namespace IQmol {
+
+namespace Data {
+   class Geometry;
+}
+
 namespace Process {
 
+   class OutputMonitor;
    class Server;
 
    // The JobMonitor handles the submission and monitoring of external 
@@ -45,7 +54,7 @@ namespace Process {
 
       public:
          static JobMonitor& instance();
-         void   loadJobListFromPreferences();
+         void   loadJobList();
 
       public Q_SLOTS:
          void submitJob(JobInfo*);
@@ -54,6 +63,9 @@ namespace Process {
          /// This signal is emitted only when a job has finished successfully.
          void resultsAvailable(QString const& path, QString const& filter, void* molPtr);
          void jobAccepted();
+         /// Geometries found in the output of a running job are passed on
+         /// as they appear.  Ownership of the Geometry passes to the receiver.
+         void geometryAvailable(Data::Geometry*, void* molPtr);
 
          void postUpdateMessage(QString const&);
 
@@ -66,7 +78,7 @@ namespace Process {
          void jobSubmissionSuccessful(Job*);
          void jobSubmissionFailed(Job*);
          void on_clearListButton_clicked(bool);
-         void on_processTable_cellDoubleClicked(int, int);
+         void on_processTable_doubleClicked(QModelIndex const&);
 
          /// Used to remove all jobs listed in the monitor.  This is triggered
          /// by a MainWindow menu action and may be useful there are rogue
@@ -74,15 +86,20 @@ namespace Process {
          /// removed.
          void removeAllJobs();
 
-         /// This is really a pseudo-update to the entries in the monitor, it
-         /// simply grabs the values that are cached in the Job objects.  The
-         /// individual Servers decide how to handle the real updates, which 
-         /// allows network requests to be minimized.  
+         /// Repaints the run times of the visible jobs while any are running.
+         /// Other changes reach the table through the JobModel as the Jobs
+         /// signal them.  The individual Servers decide how to handle the real
+         /// updates, which allows network requests to be minimized.  
          void updateTable();
 
          void reconnectServers();
          void jobUpdated();
          void jobFinished();
+         void saveModifiedJobs();
+         void aboutToQuit();
+         void outputGeometryAvailable(Data::Geometry*);
+         void outputEnergyAvailable(double);
+         void outputErrorReported(QString const&);
 
          // Context menu actions
          void contextMenu(QPoint const& position);
@@ -95,23 +112,28 @@ namespace Process {
          void openResults();
 
       private:
-         static QMap<Job*, QTableWidgetItem*> s_jobMap;
          static QList<Job*> s_deletedJobs;
 
          void initializeMenus();
-         void saveJobListToPreferences() const;
+         /// Queues the Job to be written to the JobStore
+         void saveJob(Job*);
 
          void appendToTable(Job*);
          void appendToTable(JobList&);
-         void reloadJob(Job* job);
          void removeJob(Job*);
          void queryJob(Job* job);
          void copyResults(Job* job);
          void viewOutput(Job* job);
          void openResults(Job* job);
 
+         /// Follows the output of a running job that was submitted from a
+         /// Molecule in this session.
+         void monitorOutput(Job*);
+         void stopMonitoringOutput(Job*);
+         Job* monitoredJob(QObject* outputMonitor) const;
+
          bool getQueueResources(Server*, JobInfo*);
-         Job* getSelectedJob(QTableWidgetItem* item = 0);
+         Job* getSelectedJob(QModelIndex index = QModelIndex());
 
          bool getWorkingDirectory(Server*, JobInfo*);
          bool getRemoteWorkingDirectory(Server*, QString& suggestion);
@@ -130,7 +152,11 @@ namespace Process {
          static void destroy();
 
          Ui::JobMonitor m_ui;
+         JobModel m_jobModel;
          QTimer m_updateTimer;
+         QTimer m_saveTimer;
+         QSet<Job*> m_modifiedJobs;
+         QMap<Job*, OutputMonitor*> m_outputMonitors;
    };
 
 } } // end namespace IQmol::Process
@@ -0,0 +1,83 @@
+#ifndef IQMOL_PROCESS_JOBSTORE_H
+#define IQMOL_PROCESS_JOBSTORE_H
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Job.h"
+#include <QHash>
+
+
+class QSqlQuery;
+
+namespace IQmol {
+namespace Process {
+
+   /// The JobStore is a singleton that keeps the record of submitted Jobs in
+   /// an SQLite database so that they can be picked up again in later 
+   /// sessions.  Jobs are written individually as they change, rather than 
+   /// rewriting the whole list.
+
+   class JobStore {
+
+      public:
+         static JobStore& instance();
+
+         /// Inserts or updates the records for the Jobs in a single
+         /// transaction.
+         void save(JobList const&);
+
+         void remove(Job*);
+
+         /// Removes all the stored records.
+         void clear();
+
+         /// Deletes the records for Jobs submitted more than the given number
+         /// of days ago and returns the remainder in submission order.  The
+         /// caller takes ownership of the Jobs.
+         JobList load(int const daysToRemember);
+
+         /// Closes the database connection, after which nothing more is
+         /// stored.  This needs to be done before the application exits, 
+         /// while the SQL driver is still available.
+         void close();
+
+      private:
+         static JobStore* s_instance;
+
+         JobStore();
+         explicit JobStore(JobStore const&) { }
+         ~JobStore() { }
+
+         bool execute(QSqlQuery&);
+         bool createTables();
+
+         /// Moves across the Job list stored by earlier versions in the
+         /// Preferences.
+         void importPreferences();
+
+         bool m_okay;
+         QHash<Job const*, qint64> m_rowIds;
+   };
+
+} } // end namespace IQmol::Process
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef IQMOL_PROCESS_OUTPUTMONITOR_H
+#define IQMOL_PROCESS_OUTPUTMONITOR_H
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include "Parser/QChemOutputTail.h"
+#include <QObject>
+#include <QTimer>
+
+
+namespace IQmol {
+
+namespace Data {
+   class Frequencies;
+   class Geometry;
+}
+
+namespace Network {
+   class Connection;
+   class Reply;
+}
+
+namespace Process {
+
+   /// Follows the output file of a running Q-Chem job, passing the data 
+   /// found in the new output on through the signals.  Only the bytes 
+   /// written since the last poll are read, either directly for local files
+   /// or using tail over the connection for remote ones.
+   class OutputMonitor : public QObject {
+
+      Q_OBJECT
+
+      public:
+         /// Follows a file on the local machine.
+         OutputMonitor(QString const& filePath, QObject* parent = 0);
+
+         /// Follows a file on the server at the other end of the connection.
+         OutputMonitor(Network::Connection*, QString const& filePath, 
+            QObject* parent = 0);
+
+         ~OutputMonitor();
+
+         void setInterval(int const milliseconds) { m_timer.setInterval(milliseconds); }
+
+      Q_SIGNALS:
+         /// Ownership of the data objects passes to the receiver.
+         void geometryAvailable(Data::Geometry*);
+         void energyAvailable(double);
+         void frequenciesAvailable(Data::Frequencies*);
+         void errorReported(QString const&);
+
+      public Q_SLOTS:
+         void start();
+         void stop();
+         /// Reads the remainder of the output once the job has finished 
+         /// and stops polling.
+         void finish();
+
+      private Q_SLOTS:
+         void poll();
+         void pollFinished();
+
+      private:
+         void process(QByteArray const& data, bool const final);
+         QString tailCommand() const;
+
+         Network::Connection* m_connection;
+         Network::Reply* m_reply;
+         QString m_filePath;
+         Parser::QChemOutputTail m_parser;
+         QTimer m_timer;
+         bool m_final;
+         bool m_finalRequested;
+         int  m_nErrors;
+   };
+
+} } // end namespace IQmol::Process
+
+#endif
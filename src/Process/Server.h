@@ -24,6 +24,8 @@
 #include "ServerConfiguration.h"
 #include "Connection.h"
 #include "Job.h"
+#include <QFileSystemWatcher>
+#include <QHash>
 #include <QMap>
 
 namespace IQmol {
@@ -35,6 +37,8 @@ namespace Network {
 
 namespace Process {
 
+   class OutputMonitor;
+
    class Server : public QObject {
 
       Q_OBJECT
@@ -87,6 +91,11 @@ namespace Process {
          void kill(Job*);
          void copyResults(Job*);
 
+         /// Returns a monitor that follows the output of the running job, 
+         /// or 0 if the server does not support it.  The monitor is not 
+         /// started and is owned by the caller.
+         OutputMonitor* monitorOutput(Job*, QObject* parent = 0);
+
          void setUpdateInterval(int const seconds);
          void stopUpdates()  { m_updateTimer.stop(); }
          void startUpdates() { m_updateTimer.start(); }
@@ -114,24 +123,42 @@ namespace Process {
          void killFinished();
          void copyResultsFinished();
          void queryAllJobs();
+         void batchQueryFinished();
+         void localPathChanged(QString const& path);
+         void checkLocalJobs();
 
       private:
-         QString substituteMacros(QString const&);
+         QString substituteMacros(QString const&) const;
          bool parseSubmitMessage(Job* job, QString const& message);
          bool parseQueryMessage(Job* job, QString const& message);
+
+         QString batchQueryCommand(QList<Job*> const&) const;
+         void batchQuery(QList<Job*> const&);
+         QMap<Job*, QString> splitBatchQueryMessage(QList<Job*> const&, 
+            QString const& message);
          QStringList parseListMessage(Job* job, QString const& message); 
 
+         /// Local jobs are checked when their files change rather than on
+         /// every update, see queryAllJobs()
+         void watchLocalFiles(Job*);
+         void unwatchLocalFiles(Job*);
+
          ServerConfiguration  m_configuration;
          Network::Connection* m_connection;
 
          // The Server class watches jobs, but is not responsible for them.
          QList<Job*> m_watchedJobs;
          QMap<Network::Reply*, Job*> m_activeRequests;
+         QMap<Network::Reply*, QList<Job*>> m_batchRequests;
          QList<unsigned> m_qcprogs;
          QList<unsigned> m_cmds;
          QString m_message;
 
          QTimer m_updateTimer;
+
+         QFileSystemWatcher m_localWatcher;
+         QTimer m_localCheckTimer;
+         QHash<Job*, qint64> m_changedLocalJobs;  // time of last change
    };
 
 
@@ -39,7 +39,7 @@ namespace Process {
       public:
          enum FieldT { ServerName = 0, Connection, QueueSystem, HostAddress, Port,
                        Authentication, UserName, WorkingDirectory,
-                       Submit, Query, QueueInfo, Kill,
+                       Submit, Query, BatchQuery, QueueInfo, Kill,
                        UpdateInterval, JobLimit, RunFileTemplate, Cookie, 
                        QueueResources, JobFileList, 
                        PublicKeyFile, PrivateKeyFile, KnownHostsFile, 
@@ -55,6 +55,10 @@ namespace System {
    /// raw PIDs.
    QList<unsigned int> GetParentProcessChain(unsigned int const pid);
 
+   /// Checks whether a process with the given PID is still running without
+   /// spawning a subprocess.
+   bool ProcessExists(unsigned int const pid);
+
    /// Returns the command used to submit a process either on the local machine
    /// or a basic remote linux server.
    QString SubmitCommand(bool const local = true);
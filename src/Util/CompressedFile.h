@@ -0,0 +1,70 @@
+#ifndef IQMOL_UTIL_COMPRESSEDFILE_H
+#define IQMOL_UTIL_COMPRESSEDFILE_H
+/*******************************************************************************
+
+  Copyright (C) 2025 Andrew Gilbert
+
+  This file is part of IQmol, a free molecular visualization program. See
+  <http://iqmol.org> for more details.
+
+  IQmol is free software: you can redistribute it and/or modify it under the
+  terms of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  IQmol is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along
+  with IQmol.  If not, see <http://www.gnu.org/licenses/>.
+
+********************************************************************************/
+
+#include <QFile>
+#include <QByteArray>
+
+
+namespace IQmol {
+namespace Util {
+
+   /// Write-only file that transparently compresses its contents.  The 
+   /// compression is chosen from the file suffix: '.gz' gives gzip output
+   /// (readable by zcat and most visualization packages) and '.zst' gives 
+   /// zstd output, anything else is written as is.
+   class CompressedFile {
+
+      public:
+         enum Compression { None, Gzip, Zstd };
+
+         CompressedFile(QString const& filePath);
+         ~CompressedFile();
+
+         static Compression compression(QString const& filePath);
+
+         /// Fails if the file already exists.
+         bool open();
+         bool write(char const* data, size_t const size);
+         bool write(QByteArray const& data) { return write(data.constData(), data.size()); }
+
+         /// Flushes any buffered output.  Returns false if any of the 
+         /// preceding writes failed.
+         bool close();
+
+         QString const& errorString() const { return m_error; }
+
+      private:
+         bool writeFile(char const* data, size_t const size);
+         bool fail(QString const& error);
+
+         QFile m_file;
+         Compression m_compression;
+         void* m_stream;
+         QByteArray m_buffer;
+         QString m_error;
+   };
+
+} } // end namespace IQmol::Util
+
+#endif
@@ -176,6 +176,9 @@ namespace Preferences {
    QList<QVariant> JobMonitorList();
    void JobMonitorList(QList<QVariant> const&);
 
+   QString JobStoreFilePath();
+   void    JobStoreFilePath(QString const&);
+
    QString GromacsServerAddress();
    void GromacsServerAddress(QString const&);
 
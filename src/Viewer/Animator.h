@@ -25,11 +25,17 @@
 #include "Data/Geometry.h"
 #include <QObject>
 #include <QList>
+#include <vector>
 
 
 namespace IQmol {
 
+namespace Data {
+   class GeometryList;
+}
+
 namespace Layer {
+   class Atom;
    class Surface;
    class Molecule;
 }
@@ -131,6 +137,38 @@ namespace Animator {
 
 
 
+   /// Animates a vibrational mode through the displacement amplitude of the
+   /// atoms it is given.  The mode vectors are set once on the atoms (see
+   /// Atom::setDisplacement) and atoms, bonds and labels are displaced at
+   /// draw time, so each step only updates the amplitude.  Other molecules
+   /// are unaffected and the amplitude returns to zero when the animator is
+   /// reset, finishes or is deleted.
+   class Displacement : public Base {
+
+      Q_OBJECT
+
+      public:
+         Displacement(QList<Layer::Atom*> const& atoms, double const speed, 
+            double const scaleAmplitude, double cycles = -1.0) : 
+            Base(cycles, speed, Sinusoidal), m_atoms(atoms), 
+            m_scaleAmplitude(scaleAmplitude) { }
+         ~Displacement() { setAmplitude(0.0); }
+
+         void update(double const time, double const amplitude);
+         void setScale(double const scaleAmplitude) { m_scaleAmplitude = scaleAmplitude; }
+         double getScale() const { return m_scaleAmplitude; }
+
+      public Q_SLOTS:
+         void reset();
+
+      private:
+         void setAmplitude(double const amplitude);
+         QList<Layer::Atom*> m_atoms;
+         double m_scaleAmplitude;
+   };
+
+
+
    class Move : public Movement {
 
       Q_OBJECT
@@ -167,6 +205,56 @@ namespace Animator {
 
 
 
+   /// Moves a whole set of objects along the frames of a geometry list.
+   /// Frames are fetched from the list as they are reached, so a memory
+   /// mapped list is never decoded in full.  The two frames being
+   /// interpolated are cached as contiguous coordinate buffers and each step
+   /// is one pass over them.
+   class Trajectory : public Base {
+
+      Q_OBJECT
+
+      public:
+         Trajectory(QList<Layer::GLObject*> const& objects, 
+            Data::GeometryList const& frames, double const speed, 
+            bool const bounce = false);
+
+         /// The number of frames played, which excludes any frame that does
+         /// not contain one position for each object.
+         unsigned nFrames();
+         unsigned nObjects() const { return m_objects.size(); }
+
+         void update(double const time, double const amplitude);
+         void setBounceMode(bool bounce) { m_bounce = bounce; }
+
+      public Q_SLOTS:
+         void reset();
+
+      private:
+         /// Brings m_frameIndices up to date with frames appended to (or
+         /// removed from) the list since the last call.
+         void scanFrames();
+
+         /// Returns the coordinates of the index-th played frame, or 0 if the
+         /// frame does not contain one position for each object.
+         float const* frame(unsigned const index);
+         void setFrame(unsigned const index);
+         void interpolate(unsigned const from, unsigned const to, float const amplitude);
+
+         QList<Layer::GLObject*> m_objects;
+         Data::GeometryList const& m_frames;
+         std::vector<unsigned> m_frameIndices;
+         unsigned m_nScanned;
+         std::vector<float> m_beginCoordinates;
+         std::vector<float> m_cache[2];
+         int m_cachedFrame[2];
+         unsigned m_lastUsed[2];
+         unsigned m_clock;
+         bool m_bounce;
+   };
+
+
+
    // This works a little differently from the other animators.  We must first
    // generate a list of surfaces and this class is repsonsible for determining
    // which one needs to be visible at a given time.
@@ -27,6 +27,10 @@
 
 namespace IQmol {
 
+namespace Layer {
+   class SymmetryDetector;
+}
+
    /// A simple dialog that allows the user to adjust the tolerance value
    /// passed to the SymMol program for symmetrizing nuclear coordinates.
    class SymmetryToleranceDialog : public QDialog {
@@ -35,10 +39,15 @@ namespace IQmol {
 
       public: 
          SymmetryToleranceDialog(QWidget* parent, double value);
-         ~SymmetryToleranceDialog() { }
+         ~SymmetryToleranceDialog();
 
          double value() { return m_value; }
 
+		 /// Displays the point group found at each of the tolerances
+		 /// evaluated by the detector, which is started here and owned by the
+		 /// dialog.
+         void setSymmetryDetector(Layer::SymmetryDetector*);
+
       Q_SIGNALS:
          void symmetrizeRequest(double const);
 
@@ -46,9 +55,11 @@ namespace IQmol {
          void on_toleranceSlider_valueChanged(int);
          void on_resetButton_clicked(bool);
          void on_applyButton_clicked() { symmetrizeRequest(m_value); }
+         void pointGroupsAvailable();
 
       private:
          Ui::SymmetryToleranceDialog m_symmetryToleranceDialog;
+         Layer::SymmetryDetector* m_symmetryDetector;
          double m_value;
    };
 
@@ -144,6 +144,10 @@ namespace IQmol {
          void fileOpenFinished();
          void open(QString const& fileName, QString const& filter = QString(),  
             void* moleculePointer = 0);
+         /// Passes a geometry from the output of a running job on to the 
+         /// Molecule the job was submitted from.  The geometry is discarded
+         /// if that Molecule has since been removed.
+         void appendGeometry(Data::Geometry*, void* moleculePointer);
 
 
       Q_SIGNALS: